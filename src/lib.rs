@@ -8,6 +8,7 @@ include!(concat!(env!("OUT_DIR"), "/wat.rs"));
 extern crate regex;
 
 use regex::Regex;
+use std::borrow::Cow;
 use std::ffi::{CStr,CString};
 
 pub unsafe extern "C" fn sign_event_callback(event: *mut sign_change_event) {
@@ -25,7 +26,11 @@ pub unsafe extern "C" fn sign_event_callback(event: *mut sign_change_event) {
         if line.is_empty() {
             continue
         }
-        let replaced = REGEX.replace_all(line, "§$1").replace("§&", "&");
+        let replaced = match REGEX.replace_all(line, "§$1") {
+            // No color codes, keep wat's string instead of recreating it
+            Cow::Borrowed(_) => continue,
+            Cow::Owned(replaced) => replaced.replace("§&", "&"),
+        };
 
         delete_string(&mut c_buf);
 